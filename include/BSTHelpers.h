@@ -22,6 +22,8 @@ namespace BSTHelpers {
 
     void updateHeights(const std::shared_ptr<Node> &node);
 
+    size_t treeHeight(const std::shared_ptr<Node> &node);
+
     void newLineInc(const std::shared_ptr<Node> &node);
 
     void newLineDec(const std::shared_ptr<Node> &node);
@@ -26,6 +26,8 @@ struct TextEditorBackend {
 
     size_t char_to_line(size_t i) const;
 
+    size_t height() const;
+
     void print() const;
 
 private:
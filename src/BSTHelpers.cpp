@@ -3,6 +3,7 @@
 #include <memory>
 #include <algorithm>
 #include <bitset>
+#include <vector>
 #include "../include/BSTHelpers.h"
 
 using namespace std;
@@ -113,6 +114,25 @@ namespace BSTHelpers {
         calculateHeight(node);
     }
 
+    // Measures the real height of the tree level by level.
+    // Iterative on purpose, so it also works on degenerate (list-like) trees
+    size_t treeHeight(const shared_ptr<Node> &node) {
+        size_t height = 0;
+        vector<Node *> level;
+        if (node)
+            level.push_back(node.get());
+        while (!level.empty()) {
+            vector<Node *> next;
+            for (Node *vertex: level) {
+                if (vertex->left) next.push_back(vertex->left.get());
+                if (vertex->right) next.push_back(vertex->right.get());
+            }
+            level.swap(next);
+            height++;
+        }
+        return height;
+    }
+
     // Increments newline counters for all parent nodes up to the root
     void newLineInc(const shared_ptr<Node> &node) {
         // Increment for parent if its parent's left son
@@ -154,6 +154,11 @@ size_t TextEditorBackend::char_to_line(size_t i) const {
 
 // ==================== DEBUG / DISPLAY ==================== //
 
+size_t TextEditorBackend::height() const {
+    // Return current height of the underlying tree (0 for empty text)
+    return treeHeight(root);
+}
+
 void TextEditorBackend::print() const {
     // Print the whole text (in-order traversal)
     showNode(root);
@@ -0,0 +1,285 @@
+#include <iomanip>
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <algorithm>
+#include "../include/TextEditorBackend.h"
+
+using namespace std;
+
+// ==================== TEXT EDITOR STRESS SUITE ==================== //
+//
+// Two phases:
+//  1) Differential – millions of random insert/erase/edit/line_start/char_to_line
+//     operations, every result compared against a plain std::string model.
+//     Edits switch between random, sequential and same-cursor positions every
+//     SEGMENT_OPS ops, so degenerate (chain-like) trees are checked as well.
+//  2) Scaling – tree height must stay within HEIGHT_FACTOR * log2(n) and the
+//     time per operation must stay (almost) flat while n grows 1e3 → 1e7,
+//     for sequential, random and same-cursor workloads. Every workload
+//     alternates inserts with erases, so each size is measured at constant n.
+//
+// Usage: ./textEditorStress [seed] [differential ops] [max n]
+
+class TextEditorStress {
+public:
+    TextEditorStress(uint64_t seed, size_t ops, size_t maxN) {
+        int ok = 0, fail = 0;
+        cout << "Seed: " << seed << endl;
+        differential(seed, ops, ok, fail);
+        if (!fail) scaling(seed, maxN, ok, fail);
+
+        // Print final summary
+        if (!fail) cout << "Passed all " << ok << " stress checks!" << endl;
+        else cout << "Failed " << fail << " of " << (ok + fail) << " stress checks." << endl;
+        failed = fail != 0;
+    }
+
+    bool failed = false;
+
+private:
+    static constexpr size_t MAX_MODEL_SIZE = 2048;    // keeps the O(n) reference model cheap
+    static constexpr size_t FULL_CHECK_PERIOD = 4096; // ops between whole-text comparisons
+    static constexpr size_t MIN_N = 1000;
+    static constexpr size_t SCALING_OPS = 1 << 16;
+    static constexpr size_t SEGMENT_OPS = 4096;       // differential ops per position pattern
+    static constexpr double HEIGHT_FACTOR = 4.0;
+    // Time per op at size n may be at most CACHE_TIME_FACTOR * log2(n) / log2(MIN_N)
+    // times the n = MIN_N baseline. The log term is the extra depth of a balanced
+    // tree; the fixed factor covers the tree falling out of L2 → L3 → RAM. Together
+    // ≈ 8x at n = 1e7, where a correct tree measures ~4x and an O(n^0.35) op ~25x.
+    static constexpr double CACHE_TIME_FACTOR = 3.5;
+    // Second guard against a single jump: one decade of n may cost at most 2.5x.
+    // A balanced tree gets only log2(10) ≈ 3.3 levels deeper per decade, i.e. well
+    // under 1.5x more work at n >= 1e3; the rest covers the next cache level.
+    static constexpr double DECADE_TIME_FACTOR = 2.5;
+
+    enum class Workload { Sequential, Random, SameCursor };
+
+    // Random printable character, every 8th one on average is a newline
+    static char randomChar(mt19937_64 &rng) {
+        if (rng() % 8 == 0) return '\n';
+        return static_cast<char>('a' + rng() % 26);
+    }
+
+    static string randomText(mt19937_64 &rng, size_t length) {
+        string ret(length, ' ');
+        for (char &c: ret) c = randomChar(rng);
+        return ret;
+    }
+
+    static size_t randomIndex(mt19937_64 &rng, size_t bound) {
+        return uniform_int_distribution<size_t>(0, bound - 1)(rng);
+    }
+
+    // Position in [0, bound) for the given pattern: random, or the (clamped) cursor
+    static size_t pickIndex(mt19937_64 &rng, Workload pattern, size_t cursor, size_t bound) {
+        if (pattern == Workload::Random) return randomIndex(rng, bound);
+        return min(cursor, bound - 1);
+    }
+
+    // ==================== REFERENCE MODEL ==================== //
+
+    static size_t modelLineStart(const string &s, size_t r) {
+        if (r == 0) return 0;
+        for (size_t i = 0; i < s.size(); i++)
+            if (s[i] == '\n' && --r == 0) return i + 1;
+        return s.size();
+    }
+
+    static size_t modelCharToLine(const string &s, size_t i) {
+        return count(s.begin(), s.begin() + static_cast<ptrdiff_t>(i), '\n');
+    }
+
+    static size_t modelLines(const string &s) {
+        return count(s.begin(), s.end(), '\n') + 1;
+    }
+
+    // Reports mismatch between backend and model, returns true when they agree
+    static bool expect(size_t got, size_t expected, const char *what, size_t op, int &ok, int &fail) {
+        if (got == expected) {
+            ok++;
+            return true;
+        }
+        cout << "Op " << op << ": " << what << " returned " << got
+             << ", reference model says " << expected << endl;
+        fail++;
+        return false;
+    }
+
+    // Compares whole text and all line lengths with the model
+    static bool fullCheck(const TextEditorBackend &t, const string &s, size_t op, int &ok, int &fail) {
+        for (size_t i = 0; i < s.size(); i++)
+            if (!expect(static_cast<unsigned char>(t.at(i)), static_cast<unsigned char>(s[i]), "at", op, ok, fail))
+                return false;
+        for (size_t r = 0, lines = modelLines(s); r < lines; r++) {
+            size_t end = r + 1 == lines ? s.size() : modelLineStart(s, r + 1);
+            if (!expect(t.line_length(r), end - modelLineStart(s, r), "line_length", op, ok, fail))
+                return false;
+        }
+        return true;
+    }
+
+    // ==================== PHASE 1: DIFFERENTIAL ==================== //
+    static void differential(uint64_t seed, size_t ops, int &ok, int &fail) {
+        mt19937_64 rng(seed);
+        string model = randomText(rng, MAX_MODEL_SIZE / 4);
+        TextEditorBackend t(model);
+        size_t lines = modelLines(model);
+        Workload pattern = Workload::Random;
+        size_t cursor = 0;
+
+        for (size_t op = 0; op < ops; op++) {
+            if (op % SEGMENT_OPS == 0) {
+                pattern = static_cast<Workload>(rng() % 3);
+                cursor = randomIndex(rng, model.size() + 1);
+            }
+
+            size_t kind = rng() % 100;
+            // Keep model size bounded and never erase from empty text
+            if (kind < 35 && model.size() >= MAX_MODEL_SIZE) kind = 50;
+            if (kind >= 35 && kind < 80 && model.empty()) kind = 0;
+
+            if (kind < 35) {
+                size_t i = pickIndex(rng, pattern, cursor, model.size() + 1);
+                char c = randomChar(rng);
+                t.insert(i, c);
+                model.insert(model.begin() + static_cast<ptrdiff_t>(i), c);
+                lines += c == '\n';
+                if (pattern == Workload::Sequential) cursor = i + 1;
+            } else if (kind < 65) {
+                size_t i = pickIndex(rng, pattern, cursor, model.size());
+                t.erase(i);
+                lines -= model[i] == '\n';
+                model.erase(i, 1);
+            } else if (kind < 80) {
+                size_t i = pickIndex(rng, pattern, cursor, model.size());
+                char c = randomChar(rng);
+                t.edit(i, c);
+                lines += (c == '\n') - (model[i] == '\n');
+                model[i] = c;
+            } else if (kind < 90) {
+                size_t r = randomIndex(rng, lines);
+                if (!expect(t.line_start(r), modelLineStart(model, r), "line_start", op, ok, fail)) break;
+            } else if (!model.empty()) {
+                size_t i = randomIndex(rng, model.size());
+                if (!expect(t.char_to_line(i), modelCharToLine(model, i), "char_to_line", op, ok, fail)) break;
+            }
+
+            if (!expect(t.size(), model.size(), "size", op, ok, fail)) break;
+            if (!expect(t.lines(), lines, "lines", op, ok, fail)) break;
+            if (op % FULL_CHECK_PERIOD == 0 && !fullCheck(t, model, op, ok, fail)) break;
+        }
+        if (!fail) fullCheck(t, model, ops, ok, fail);
+
+        cout << "Differential: " << ops << " ops against std::string model – "
+             << (fail ? "FAILED" : "OK") << endl;
+    }
+
+    // ==================== PHASE 2: SCALING ==================== //
+
+    // One step of a workload: an edit followed by line queries.
+    // Even steps insert at the workload's position, odd steps erase a random
+    // character, so n stays constant for the whole measurement
+    static void step(TextEditorBackend &t, Workload workload, size_t &cursor, size_t op, mt19937_64 &rng) {
+        size_t pos = cursor;
+        if (workload == Workload::Random) pos = randomIndex(rng, t.size() + 1);
+
+        if (op % 2 == 1) {
+            pos = randomIndex(rng, t.size());
+            t.erase(pos);
+            // Keep typing right after the previously typed text
+            if (workload == Workload::Sequential && pos < cursor) cursor--;
+        } else {
+            t.insert(pos, randomChar(rng));
+            if (workload == Workload::Sequential) cursor++;
+        }
+
+        size_t line = t.char_to_line(min(pos, t.size() - 1));
+        t.line_start(line);
+    }
+
+    static const char *name(Workload workload) {
+        switch (workload) {
+            case Workload::Sequential: return "sequential";
+            case Workload::Random: return "random";
+            default: return "same-cursor";
+        }
+    }
+
+    static void scaling(uint64_t seed, size_t maxN, int &ok, int &fail) {
+        for (Workload workload: {Workload::Sequential, Workload::Random, Workload::SameCursor}) {
+            cout << "Scaling (" << name(workload) << "):" << endl;
+            double baseline = 0, previous = 0;
+
+            for (size_t n = MIN_N; n <= maxN; n *= 10) {
+                mt19937_64 rng(seed ^ n);
+                TextEditorBackend t(randomText(rng, n));
+                size_t cursor = n / 2;
+
+                // Ops are run in doubling chunks; height is checked between chunks (outside timing),
+                // so a degenerate tree is caught before it makes the run quadratic
+                chrono::nanoseconds elapsed(0);
+                size_t done = 0, height = 0;
+                double bound = 0;
+                bool balanced = true;
+                for (size_t chunk = 1024; done < SCALING_OPS && balanced; chunk *= 2) {
+                    auto start = chrono::steady_clock::now();
+                    for (size_t end = min(done + chunk, SCALING_OPS); done < end; done++)
+                        step(t, workload, cursor, done, rng);
+                    elapsed += chrono::steady_clock::now() - start;
+
+                    height = t.height();
+                    bound = HEIGHT_FACTOR * log2(static_cast<double>(t.size()));
+                    balanced = height <= bound;
+                }
+
+                double perOp = static_cast<double>(elapsed.count()) / static_cast<double>(done);
+                if (n == MIN_N) baseline = perOp;
+                double allowed = min(baseline * CACHE_TIME_FACTOR * log2(static_cast<double>(n)) /
+                                     log2(static_cast<double>(MIN_N)), previous * DECADE_TIME_FACTOR);
+
+                auto flags = cout.flags();
+                auto precision = cout.precision();
+                cout << fixed << "  n = " << setw(9) << n
+                     << "  height = " << setw(6) << height << " (bound " << setprecision(0) << bound << ")"
+                     << "  " << setprecision(1) << setw(9) << perOp << " ns/op";
+                if (n == MIN_N) cout << " (baseline)" << endl;
+                else cout << " (allowed " << allowed << ")" << endl;
+
+                bool passed = balanced && (n == MIN_N || perOp <= allowed);
+                if (!balanced) {
+                    cout << "  Height " << height << " exceeds " << HEIGHT_FACTOR << "*log2(n) after "
+                         << done << " ops – tree degenerates, skipping larger n" << endl;
+                    fail++;
+                } else if (n != MIN_N && perOp > allowed) {
+                    // Time check only from the second size on, the baseline cannot fail it
+                    cout << "  Time per op grew from " << baseline << " ns (n = " << MIN_N << ") and "
+                         << previous << " ns (n = " << n / 10 << ") to " << perOp << " ns" << endl;
+                    fail++;
+                }
+                cout.flags(flags);
+                cout.precision(precision);
+                if (!passed) break;
+
+                ok += n == MIN_N ? 1 : 2;
+                previous = perOp;
+            }
+        }
+    }
+};
+
+// ==================== MAIN ==================== //
+// Entry point – optional arguments: seed, differential op count, max n
+int main(int argc, char *argv[]) {
+    uint64_t seed = argc > 1 ? stoull(argv[1]) : 20241018;
+    size_t ops = argc > 2 ? stoull(argv[2]) : 2'000'000;
+    size_t maxN = argc > 3 ? stoull(argv[3]) : 10'000'000;
+
+    TextEditorStress stress(seed, ops, maxN);
+    return stress.failed ? 1 : 0;
+}